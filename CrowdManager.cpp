@@ -142,4 +142,23 @@ Route CrowdManager::findLeastCrowdedRoute(int startStationId, int endStationId)
     route.averageCongestion = routeCongestion[endStationId];
     
     return route;
-}
\ No newline at end of file
+}
+
+std::vector<ReachableStation> CrowdManager::findReachableStations(const std::vector<int>& sourceStationIds,
+                                                                  int timeBudget) const {
+    // Same penalty as findLeastCrowdedRoute: weight each hop by the congestion at its destination
+    return subwayMap->findReachableStations(sourceStationIds, timeBudget,
+        [this](const Connection& connection) {
+            return calculateWeightedTravelTime(connection.travelTime,
+                                               getStationCongestion(connection.toStationId));
+        });
+}
+
+std::vector<Isochrone> CrowdManager::buildAllIsochrones(int timeBudget, unsigned int threadCount) const {
+    return subwayMap->buildAllIsochrones(timeBudget,
+        [this](const Connection& connection) {
+            return calculateWeightedTravelTime(connection.travelTime,
+                                               getStationCongestion(connection.toStationId));
+        },
+        threadCount);
+}
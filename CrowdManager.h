@@ -35,6 +35,14 @@ public:
     
     // Find the least crowded route between two stations using a greedy approach
     Route findLeastCrowdedRoute(int startStationId, int endStationId) const;
+    
+    // Find all stations reachable within the time budget using congestion-weighted travel times
+    std::vector<ReachableStation> findReachableStations(const std::vector<int>& sourceStationIds,
+                                                        int timeBudget) const;
+    
+    // Build a congestion-weighted isochrone for every station in parallel.
+    // Congestion levels must not be updated while this is running.
+    std::vector<Isochrone> buildAllIsochrones(int timeBudget, unsigned int threadCount = 0) const;
 };
 
 #endif // CROWD_MANAGER_H
\ No newline at end of file
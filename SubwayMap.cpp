@@ -2,6 +2,8 @@
 #include <queue>
 #include <limits>
 #include <algorithm>
+#include <thread>
+#include <atomic>
 
 SubwayMap::SubwayMap() {}
 
@@ -123,4 +125,103 @@ Route SubwayMap::findShortestRoute(int startStationId, int endStationId) const {
     route.totalTime = distances[endStationId];
     
     return route;
-}
\ No newline at end of file
+}
+
+// Bounded multi-source Dijkstra: only stations within the time budget are ever visited
+std::vector<ReachableStation> SubwayMap::findReachableStations(const std::vector<int>& sourceStationIds,
+                                                               int timeBudget,
+                                                               const TravelTimeFunction& travelTimeOf) const {
+    std::vector<ReachableStation> result;
+    
+    if (timeBudget < 0) {
+        return result;
+    }
+    
+    // Best known distance to each station touched by the search
+    std::map<int, int> distances;
+    
+    // Priority queue for Dijkstra's algorithm
+    // Pair: (distance, stationId)
+    std::priority_queue<std::pair<int, int>, 
+                        std::vector<std::pair<int, int>>, 
+                        std::greater<std::pair<int, int>>> pq;
+    
+    // Every source starts at distance 0
+    for (int sourceId : sourceStationIds) {
+        if (stationExists(sourceId) && distances.find(sourceId) == distances.end()) {
+            distances[sourceId] = 0;
+            pq.push({0, sourceId});
+        }
+    }
+    
+    while (!pq.empty()) {
+        int currentDistance = pq.top().first;
+        int currentStationId = pq.top().second;
+        pq.pop();
+        
+        // If we've already found a shorter path to this station, skip
+        if (currentDistance > distances[currentStationId]) {
+            continue;
+        }
+        
+        // Stations are settled in order of travel time
+        result.push_back({currentStationId, currentDistance});
+        
+        auto it = connections.find(currentStationId);
+        if (it == connections.end()) {
+            continue;
+        }
+        
+        for (const auto& connection : it->second) {
+            int travelTime = travelTimeOf ? travelTimeOf(connection) : connection.travelTime;
+            int newDistance = currentDistance + travelTime;
+            
+            // Prune anything beyond the time budget
+            if (newDistance > timeBudget) {
+                continue;
+            }
+            
+            auto known = distances.find(connection.toStationId);
+            if (known == distances.end() || newDistance < known->second) {
+                distances[connection.toStationId] = newDistance;
+                pq.push({newDistance, connection.toStationId});
+            }
+        }
+    }
+    
+    return result;
+}
+
+std::vector<Isochrone> SubwayMap::buildAllIsochrones(int timeBudget,
+                                                     const TravelTimeFunction& travelTimeOf,
+                                                     unsigned int threadCount) const {
+    std::vector<Isochrone> isochrones;
+    for (const auto& pair : stations) {
+        isochrones.push_back({pair.first, timeBudget, {}});
+    }
+    
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = std::min<unsigned int>(threadCount, static_cast<unsigned int>(isochrones.size()));
+    
+    // Workers pull the next station index; each one only writes to its own isochrone
+    std::atomic<size_t> nextIndex(0);
+    auto worker = [&]() {
+        for (size_t i = nextIndex++; i < isochrones.size(); i = nextIndex++) {
+            isochrones[i].stations = findReachableStations({isochrones[i].sourceStationId},
+                                                           timeBudget, travelTimeOf);
+        }
+    };
+    
+    std::vector<std::thread> workers;
+    for (unsigned int t = 1; t < threadCount; t++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    
+    return isochrones;
+}
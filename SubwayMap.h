@@ -4,8 +4,25 @@
 #include <vector>
 #include <map>
 #include <string>
+#include <functional>
 #include "models.h"
 
+// A station reached by a range query, with its travel time from the nearest source
+struct ReachableStation {
+    int stationId;
+    int travelTime;
+};
+
+// All stations reachable from a source within a time budget, ordered by travel time
+struct Isochrone {
+    int sourceStationId;
+    int timeBudget;
+    std::vector<ReachableStation> stations;
+};
+
+// Returns the cost of traversing a connection; used to apply penalties such as crowding
+using TravelTimeFunction = std::function<int(const Connection&)>;
+
 class SubwayMap {
 private:
     // Map of station ID to Station object
@@ -38,6 +55,18 @@ public:
     
     // Find the shortest route between two stations using Dijkstra's algorithm
     Route findShortestRoute(int startStationId, int endStationId) const;
+    
+    // Find all stations reachable from any of the source stations within the time budget
+    // using a single bounded Dijkstra search. Uses plain travel times unless travelTimeOf is given.
+    std::vector<ReachableStation> findReachableStations(const std::vector<int>& sourceStationIds,
+                                                        int timeBudget,
+                                                        const TravelTimeFunction& travelTimeOf = nullptr) const;
+    
+    // Build an isochrone for every station, running the searches on threadCount worker
+    // threads (0 = hardware concurrency). travelTimeOf must be safe to call concurrently.
+    std::vector<Isochrone> buildAllIsochrones(int timeBudget,
+                                              const TravelTimeFunction& travelTimeOf = nullptr,
+                                              unsigned int threadCount = 0) const;
 };
 
 #endif // SUBWAY_MAP_H
\ No newline at end of file
@@ -73,7 +73,8 @@ void displayMenu() {
     std::cout << "3. Display all stations\n";
     std::cout << "4. Display crowd levels\n";
     std::cout << "5. Simulate crowd change\n";
-    std::cout << "6. Exit\n";
+    std::cout << "6. Find stations reachable within a time limit\n";
+    std::cout << "7. Exit\n";
     std::cout << "Enter your choice: ";
 }
 
@@ -226,7 +227,40 @@ int main() {
                           << subwayMap.getStationName(stationId) << " to " << newLevel << "%\n";
                 break;
             }
-            case 6:
+            case 6: {
+                // Find stations reachable within a time limit
+                int startId = getValidStationId(subwayMap, "Enter start station ID: ");
+                int timeBudget;
+                
+                do {
+                    std::cout << "Enter time limit in minutes: ";
+                    if (!(std::cin >> timeBudget) || timeBudget < 0) {
+                        std::cin.clear();
+                        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                        std::cout << "Invalid input. Please enter a non-negative number.\n";
+                    } else {
+                        break;
+                    }
+                } while (true);
+                
+                auto plain = subwayMap.findReachableStations({startId}, timeBudget);
+                auto crowded = crowdManager.findReachableStations({startId}, timeBudget);
+                
+                std::cout << "\n----- Reachable within " << timeBudget << " minutes from "
+                          << subwayMap.getStationName(startId) << " -----\n";
+                std::cout << "Without crowd penalties:\n";
+                for (const auto& reached : plain) {
+                    std::cout << "  " << subwayMap.getStationName(reached.stationId)
+                              << ": " << reached.travelTime << " min\n";
+                }
+                std::cout << "With crowd penalties:\n";
+                for (const auto& reached : crowded) {
+                    std::cout << "  " << subwayMap.getStationName(reached.stationId)
+                              << ": " << reached.travelTime << " min\n";
+                }
+                break;
+            }
+            case 7:
                 // Exit
                 std::cout << "Thank you for using the Intelligent Subway Route Planner!\n";
                 running = false;